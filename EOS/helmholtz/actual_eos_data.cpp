@@ -9,17 +9,50 @@ AMREX_GPU_MANAGED amrex::Real helmholtz::t[jmax];
 AMREX_GPU_MANAGED amrex::Real helmholtz::ttol;
 AMREX_GPU_MANAGED amrex::Real helmholtz::dtol;
 
+AMREX_GPU_MANAGED int helmholtz::max_newton;
+AMREX_GPU_MANAGED int helmholtz::newton_bracket;
+
+#ifdef HELM_CELL_TABLE
+
+// one record per (T, rho) cell
+#ifdef NODE_SHARED_TABLES
+amrex::Real (*helmholtz::cell_table)[imax-1][cell_size];
+#else
+AMREX_GPU_MANAGED amrex::Real helmholtz::cell_table[jmax-1][imax-1][cell_size];
+#endif
+
+#elif defined(NODE_SHARED_TABLES)
+
+// pointers into the node-shared tables
+helmholtz::table_real_t (*helmholtz::f)[imax][9];
+helmholtz::table_real_t (*helmholtz::dpdf)[imax][4];
+helmholtz::table_real_t (*helmholtz::ef)[imax][4];
+helmholtz::table_real_t (*helmholtz::xf)[imax][4];
+
+#ifdef HELM_FLOAT_TABLE
+std::int16_t (*helmholtz::table_exp)[imax][4];
+#endif
+
+#else
+
 // for the helmholtz free energy tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::f[jmax][imax][9];
+AMREX_GPU_MANAGED helmholtz::table_real_t helmholtz::f[jmax][imax][9];
 
 // for the pressure derivative with density tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::dpdf[jmax][imax][4];
+AMREX_GPU_MANAGED helmholtz::table_real_t helmholtz::dpdf[jmax][imax][4];
 
 // for chemical potential tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::ef[jmax][imax][4];
+AMREX_GPU_MANAGED helmholtz::table_real_t helmholtz::ef[jmax][imax][4];
 
 // for the number density tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::xf[jmax][imax][4];
+AMREX_GPU_MANAGED helmholtz::table_real_t helmholtz::xf[jmax][imax][4];
+
+#ifdef HELM_FLOAT_TABLE
+// for the scale exponents of the single precision tables
+AMREX_GPU_MANAGED std::int16_t helmholtz::table_exp[jmax][imax][4];
+#endif
+
+#endif
 
 // for storing the differences
 AMREX_GPU_MANAGED amrex::Real helmholtz::dt_sav[jmax];
@@ -31,3 +64,7 @@ AMREX_GPU_MANAGED amrex::Real helmholtz::dd_sav[imax];
 AMREX_GPU_MANAGED amrex::Real helmholtz::dd2_sav[imax];
 AMREX_GPU_MANAGED amrex::Real helmholtz::ddi_sav[imax];
 AMREX_GPU_MANAGED amrex::Real helmholtz::dd2i_sav[imax];
+
+// for the tabulated Coulomb corrections
+AMREX_GPU_MANAGED int helmholtz::coulomb_table;
+AMREX_GPU_MANAGED amrex::Real helmholtz::coul_table[coul_noct][coul_nper+1][6];
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+
+"""Convert the text Helmholtz free energy table (helm_table.dat) into
+a binary file that actual_eos_init can read directly instead of
+parsing the text.
+
+The binary table is laid out as (all values little-endian):
+
+  header:
+    char[8]   magic ("MPHELMTB")
+    uint32    byte-order marker (0x01020304)
+    uint32    version
+    uint32    imax (number of density points)
+    uint32    jmax (number of temperature points)
+    float64   tlo, thi (log10 of the temperature bounds)
+    float64   dlo, dhi (log10 of the density bounds)
+    uint32    CRC-32 of the payload
+    uint32    CRC-32 of the text table it was made from
+
+  payload:
+    float64[jmax*imax*9]  free energy and its derivatives
+    float64[jmax*imax*4]  pressure derivative with density
+    float64[jmax*imax*4]  electron chemical potential
+    float64[jmax*imax*4]  number density
+
+Each table is stored with the values at a point varying fastest,
+then density, then temperature.  The values at each point are
+reordered from the columns of the text table in the same way that
+actual_eos_init does when it reads the text table, so the payload can
+be copied directly into the table arrays.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+import numpy as np
+
+# these need to match table_checksum::helm in util/table_checksum.H
+
+MAGIC = b"MPHELMTB"
+BYTE_ORDER_MARKER = 0x01020304
+VERSION = 2
+
+HEADER_FMT = "<8sIIIIddddII"
+
+# these need to match actual_eos_data.H
+IMAX = 541
+JMAX = 201
+TLO = 3.0
+THI = 13.0
+DLO = -12.0
+DHI = 15.0
+
+# where each column of the text table goes in the values stored at a
+# point -- this is the reordering done when reading the text table in
+# actual_eos_init
+F_ORDER = [0, 3, 1, 4, 2, 5, 6, 7, 8]
+DERIV_ORDER = [0, 2, 1, 3]
+
+
+def reorder(block, order):
+    """reorder the values at each point of one table in the same way
+    as actual_eos_init"""
+
+    out = np.empty_like(block)
+    out[:, order] = block
+    return out
+
+
+def make_table(table, output):
+    """write the binary version of the text table"""
+
+    with open(table, "rb") as f:
+        text = f.read()
+
+    # the table is just whitespace-separated numbers: the jmax*imax
+    # lines of the free energy, with 9 values each, followed by the
+    # three tables with 4 values each
+
+    npts = JMAX * IMAX
+
+    data = np.array(text.split(), dtype=np.float64)
+    if data.size != 21 * npts:
+        sys.exit(f"error: {table} has {data.size} values, expected {21 * npts}")
+
+    f_tab = data[:9*npts].reshape(npts, 9)
+    dpdf, ef, xf = data[9*npts:].reshape(3, npts, 4)
+
+    payload = np.concatenate([reorder(f_tab, F_ORDER).ravel(),
+                              reorder(dpdf, DERIV_ORDER).ravel(),
+                              reorder(ef, DERIV_ORDER).ravel(),
+                              reorder(xf, DERIV_ORDER).ravel()]).astype("<f8").tobytes()
+
+    header = struct.pack(HEADER_FMT, MAGIC, BYTE_ORDER_MARKER, VERSION, IMAX, JMAX,
+                         TLO, THI, DLO, DHI, zlib.crc32(payload), zlib.crc32(text))
+
+    with open(output, "wb") as f:
+        f.write(header + payload)
+
+
+def main():
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-o", "--output", type=str, default="helm_table.bin",
+                        help="name of the binary table to write")
+    parser.add_argument("table", type=str, nargs="?", default="helm_table.dat",
+                        help="the text table to convert")
+
+    args = parser.parse_args()
+
+    make_table(args.table, args.output)
+
+
+if __name__ == "__main__":
+    main()
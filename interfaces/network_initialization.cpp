@@ -35,5 +35,10 @@ nonaka_init();
     // read in the NSE table (if there is one)
     init_nse();
 #endif
+
+#ifdef NSE_NET
+    // build the table of guesses for the NSE solve (if enabled)
+    init_nse_guess_table();
+#endif
 #endif
 }
@@ -1,4 +1,7 @@
 #include <actual_network.H>
+#ifdef SCREENING
+#include <actual_screen_pairs.H>
+#endif
 
 
 #ifdef NSE_NET
@@ -76,6 +79,41 @@ namespace NSE_INDEX
 }
 #endif
 
+#ifdef SCREENING
+namespace ScreenPairs
+{
+    AMREX_GPU_MANAGED amrex::Array1D<scrn::screen_factors_t, 1, nscreen> scn_facs {{
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 6.0_rt, 12.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 6.0_rt, 12.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 6.0_rt, 13.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 7.0_rt, 13.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 7.0_rt, 14.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 7.0_rt, 14.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 7.0_rt, 15.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 7.0_rt, 15.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 8.0_rt, 14.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 8.0_rt, 15.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 8.0_rt, 16.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 8.0_rt, 16.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 8.0_rt, 17.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 8.0_rt, 18.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 9.0_rt, 17.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 9.0_rt, 18.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 9.0_rt, 19.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 10.0_rt, 18.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 10.0_rt, 20.0_rt),
+        scrn::calculate_screen_factor(6.0_rt, 12.0_rt, 6.0_rt, 12.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 7.0_rt, 13.0_rt),
+        scrn::calculate_screen_factor(6.0_rt, 12.0_rt, 8.0_rt, 16.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 9.0_rt, 17.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 10.0_rt, 20.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 12.0_rt, 24.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 2.0_rt, 4.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 4.0_rt, 8.0_rt)
+    }};
+}
+#endif
+
 void actual_network_init()
 {
 
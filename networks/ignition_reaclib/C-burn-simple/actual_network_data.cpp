@@ -1,4 +1,7 @@
 #include <actual_network.H>
+#ifdef SCREENING
+#include <actual_screen_pairs.H>
+#endif
 
 
 #ifdef NSE_NET
@@ -14,6 +17,16 @@ namespace NSE_INDEX
 }
 #endif
 
+#ifdef SCREENING
+namespace ScreenPairs
+{
+    AMREX_GPU_MANAGED amrex::Array1D<scrn::screen_factors_t, 1, nscreen> scn_facs {{
+        scrn::calculate_screen_factor(6.0_rt, 12.0_rt, 6.0_rt, 12.0_rt),
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 6.0_rt, 12.0_rt)
+    }};
+}
+#endif
+
 void actual_network_init()
 {
 
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+
+"""Convert the tabulated weak rate files (*_electroncapture.dat and
+*_betadecay.dat) into a single binary blob that the networks can
+mmap at initialization instead of parsing the text tables.
+
+The blob is laid out as (all values little-endian):
+
+  header:
+    char[8]   magic ("MPWKRATE")
+    uint32    byte-order marker (0x01020304)
+    uint32    version
+    uint32    number of tables
+    uint32    length of the name field in the directory entries
+    uint32    CRC-32 of the directory
+    uint32    padding
+
+  directory (one entry per table):
+    char[name_len]  table file name (NUL padded)
+    uint32          ntemp
+    uint32          nrhoy
+    uint32          nvars
+    uint32          CRC-32 of the payload
+    uint64          offset of the payload from the start of the file
+
+  payload (one per table, 8-byte aligned):
+    float64[nrhoy]              log10(rhoY) grid
+    float64[ntemp]              log10(T) grid
+    float64[ntemp*nrhoy*nvars]  data, with temperature varying fastest,
+                                then rhoY, then the variable
+
+The data ordering matches the amrex::Array3D<Real, 1, ntemp, 1, nrhoy,
+1, nvars> storage used in table_rates.H.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+# these need to match networks/weak_rate_blob.cpp
+
+MAGIC = b"MPWKRATE"
+BYTE_ORDER_MARKER = 0x01020304
+VERSION = 2
+NAME_LEN = 64
+
+HEADER_FMT = "<8sIIIIII"
+ENTRY_FMT = f"<{NAME_LEN}sIIIIQ"
+
+
+def read_table(filename):
+    """read a text table, returning the rhoY and T grids and the data
+    (as a list of rows)"""
+
+    rows = []
+    with open(filename) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("!"):
+                continue
+            rows.append([float(v) for v in line.split()])
+
+    # the rows are ordered with T varying fastest
+
+    log_rhoy = []
+    log_temp = []
+    for r in rows:
+        if not log_rhoy or r[0] != log_rhoy[-1]:
+            log_rhoy.append(r[0])
+        if len(log_rhoy) == 1:
+            log_temp.append(r[1])
+
+    ntemp = len(log_temp)
+    nrhoy = len(log_rhoy)
+    nvars = len(rows[0]) - 2
+
+    if len(rows) != ntemp * nrhoy:
+        sys.exit(f"error: {filename} is not a complete rhoY x T grid")
+
+    # reorder to temperature fastest, then rhoY, then variable
+
+    data = []
+    for n in range(nvars):
+        for j in range(nrhoy):
+            for i in range(ntemp):
+                data.append(rows[j * ntemp + i][n + 2])
+
+    return log_rhoy, log_temp, nvars, data
+
+
+def make_blob(tables, output):
+    """write the blob for the list of table files"""
+
+    header_size = struct.calcsize(HEADER_FMT)
+    entry_size = struct.calcsize(ENTRY_FMT)
+
+    offset = header_size + len(tables) * entry_size
+    offset = (offset + 7) // 8 * 8
+
+    directory = b""
+    payloads = b""
+
+    for t in tables:
+        name = os.path.basename(t).encode()
+        if len(name) >= NAME_LEN:
+            sys.exit(f"error: table name {t} is too long")
+
+        log_rhoy, log_temp, nvars, data = read_table(t)
+
+        payload = struct.pack(f"<{len(log_rhoy)}d", *log_rhoy)
+        payload += struct.pack(f"<{len(log_temp)}d", *log_temp)
+        payload += struct.pack(f"<{len(data)}d", *data)
+
+        directory += struct.pack(ENTRY_FMT, name, len(log_temp), len(log_rhoy), nvars,
+                                 zlib.crc32(payload), offset + len(payloads))
+        payloads += payload
+
+    header = struct.pack(HEADER_FMT, MAGIC, BYTE_ORDER_MARKER, VERSION, len(tables), NAME_LEN,
+                         zlib.crc32(directory), 0)
+
+    pad = b"\0" * (offset - header_size - len(directory))
+
+    with open(output, "wb") as f:
+        f.write(header + directory + pad + payloads)
+
+
+def main():
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-o", "--output", type=str, default="weak_rate_tables.bin",
+                        help="name of the binary blob to write")
+    parser.add_argument("tables", type=str, nargs="+",
+                        help="the text tables to convert")
+
+    args = parser.parse_args()
+
+    make_blob(sorted(args.tables, key=os.path.basename), args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,4 +1,5 @@
 #include <actual_network.H>
+#include <actual_screen_pairs.H>
 
 
 #ifdef NSE_NET
@@ -15,6 +16,14 @@ namespace NSE_INDEX
 }
 #endif
 
+namespace ScreenPairs
+{
+    AMREX_GPU_MANAGED amrex::Array1D<scrn::screen_factors_t, 1, nscreen> scn_facs {{
+        scrn::calculate_screen_factor(2.0_rt, 4.0_rt, 26.0_rt, 52.0_rt),
+        scrn::calculate_screen_factor(1.0_rt, 1.0_rt, 27.0_rt, 55.0_rt)
+    }};
+}
+
 void actual_network_init()
 {
 
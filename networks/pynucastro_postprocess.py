@@ -0,0 +1,1201 @@
+#!/usr/bin/env python3
+
+"""Apply the Microphysics-specific changes to the C++ code that
+pynucastro writes for a network.
+
+pynucastro's templates do not (yet) know about several optimizations
+that Microphysics makes to its networks, so after a network is
+regenerated (see update_pynucastro_nets.py), we patch the output:
+
+  * the ReacLib rates are evaluated through evaluate_reaclib_rates(),
+    which can use the temperature tables in reaclib_rate_tables.H
+    (network.use_tables)
+
+  * the partition functions locate the temperature in each T9 grid
+    once and fill all of the species together
+
+  * each unique pair of nuclei is screened once, using a single
+    batched call to actual_screen().  The screening factors are put in
+    a small generated header, actual_screen_pairs.H
+
+  * for the networks in WEAK_RATE_STORE_NETWORKS, the weak rate tables
+    can be read from a binary blob (see make_weak_rate_blob.py) and
+    are interpolated together on their shared (rhoY, T) grid
+
+Each change is only applied if the code it modifies is present, so
+this is a no-op for networks without those features and running it
+on an already processed network does nothing.
+
+usage: pynucastro_postprocess.py network_dir [network_dir ...]
+"""
+
+import re
+import sys
+from pathlib import Path
+
+# the networks whose weak rate tables are packed into a binary blob.
+# This needs to match WEAK_RATE_BLOB_NETWORKS in Make.Microphysics_extern
+WEAK_RATE_STORE_NETWORKS = ["sn160"]
+
+
+def replace_once(s, old, new, fname):
+    """replace the single occurrence of old with new in s"""
+    if s.count(old) != 1:
+        raise ValueError(f"{fname}: expected to find exactly one of:\n{old}")
+    return s.replace(old, new, 1)
+
+
+def insert_after(s, marker, text, fname):
+    """insert text after the single occurrence of marker in s"""
+    return replace_once(s, marker, marker + text, fname)
+
+
+# ---------------------------------------------------------------------
+# ReacLib rate tables
+# ---------------------------------------------------------------------
+
+REACLIB_INIT = """
+    if (use_tables) {
+        reaclib_tables::init_reaclib_tables();
+        reaclib_tables::report_reaclib_table_accuracy();
+    }
+"""
+
+
+def use_reaclib_rate_tables(net_dir):
+    """evaluate the ReacLib rates via evaluate_reaclib_rates(), which
+    interpolates them from a temperature table if use_tables is set"""
+
+    rhs_file = net_dir / "actual_rhs.H"
+    s = rhs_file.read_text()
+
+    if "fill_reaclib_rates<do_T_derivatives, T>(tfactors, rate_eval);" not in s:
+        return
+
+    s = insert_after(s, "#include <reaclib_rates.H>\n",
+                     "#include <reaclib_rate_tables.H>\n", rhs_file)
+    s = replace_once(s, "fill_reaclib_rates<do_T_derivatives, T>(tfactors, rate_eval);",
+                     "evaluate_reaclib_rates<do_T_derivatives, T>(state.T, tfactors, rate_eval);",
+                     rhs_file)
+    s = insert_after(s, "    init_tabular();\n", REACLIB_INIT, rhs_file)
+    rhs_file.write_text(s)
+
+    make_file = net_dir / "Make.package"
+    s = make_file.read_text()
+    s = insert_after(s, "  CEXE_headers += reaclib_rates.H\n",
+                     "  CEXE_headers += reaclib_rate_tables.H\n"
+                     "  CEXE_sources += reaclib_rate_tables.cpp\n", make_file)
+    make_file.write_text(s)
+
+
+# ---------------------------------------------------------------------
+# partition functions
+# ---------------------------------------------------------------------
+
+INTERP_ARR1D = """    // interpolation routine
+
+    template <typename T>
+    AMREX_GPU_HOST_DEVICE AMREX_INLINE
+    void interpolate_pf(const amrex::Real t9, const T& temp_array, const T& pf_array,
+                        amrex::Real& pf, amrex::Real& dpf_dT) {
+"""
+
+INTERP_CARR = """    // interpolation routine
+
+    template <int npts>
+    AMREX_GPU_HOST_DEVICE AMREX_INLINE
+    void interpolate_pf(const amrex::Real t9, const amrex::Real (&temp_array)[npts], const amrex::Real (&pf_array)[npts],
+                        amrex::Real& pf, amrex::Real& dpf_dT) {
+"""
+
+PF_INDEX_ARR1D = """    // The T9 grid is shared by all of the partition functions, so we
+    // locate the temperature in it once and reuse the index and
+    // interpolation weights for every species.
+
+    struct pf_index_t {
+        // temp_array(idx) <= t9 < temp_array(idx+1), or -1 if t9 is
+        // outside of the table
+        int idx;
+        amrex::Real dt9;
+        amrex::Real dt9_inv;
+    };
+
+    template <typename T>
+    AMREX_GPU_HOST_DEVICE AMREX_INLINE
+    pf_index_t get_pf_index(const amrex::Real t9, const T& temp_array) {
+
+        // the arrays are dimensioned with one extra (unused) element
+
+        const int npts = temp_array.hi() - temp_array.lo();
+
+        pf_index_t index{-1, 0.0_rt, 0.0_rt};
+
+        if (t9 >= temp_array(0) && t9 < temp_array(npts-1)) {
+
+            // find the largest temperature element <= t9 using a binary search
+
+            int left = 0;
+            int right = npts;
+
+            while (left < right) {
+                int mid = (left + right) / 2;
+                if (temp_array(mid) > t9) {
+                    right = mid;
+                } else {
+                    left = mid + 1;
+                }
+            }
+
+            index.idx = right - 1;
+            index.dt9 = t9 - temp_array(index.idx);
+            index.dt9_inv = 1.0_rt / (temp_array(index.idx+1) - temp_array(index.idx));
+        }
+
+        return index;
+
+    }
+"""
+
+PF_INDEX_CARR = """    // The T9 grid is shared by all of the partition functions, so we
+    // locate the temperature in it once and reuse the index and
+    // interpolation weights for every species.
+
+    struct pf_index_t {
+        // temp_array[idx] <= t9 < temp_array[idx+1], or -1 if t9 is
+        // outside of the table
+        int idx;
+        amrex::Real dt9;
+        amrex::Real dt9_inv;
+    };
+
+    template <int npts>
+    AMREX_GPU_HOST_DEVICE AMREX_INLINE
+    pf_index_t get_pf_index(const amrex::Real t9, const amrex::Real (&temp_array)[npts]) {
+
+        pf_index_t index{-1, 0.0_rt, 0.0_rt};
+
+        if (t9 >= temp_array[0] && t9 < temp_array[npts-1]) {
+
+            // find the largest temperature element <= t9 using a binary search
+
+            int left = 0;
+            int right = npts;
+
+            while (left < right) {
+                int mid = (left + right) / 2;
+                if (temp_array[mid] > t9) {
+                    right = mid;
+                } else {
+                    left = mid + 1;
+                }
+            }
+
+            index.idx = right - 1;
+            index.dt9 = t9 - temp_array[index.idx];
+            index.dt9_inv = 1.0_rt / (temp_array[index.idx+1] - temp_array[index.idx]);
+        }
+
+        return index;
+
+    }
+"""
+
+# the rest of the part_fun namespace.  {i} and {ip1} are the element
+# accesses for the array type, {interp_sig} is the original
+# interpolate_pf signature, which is kept as a wrapper, and
+# {cache_data} is the original declaration of the pf_cache_t data.
+PF_INTERP = """
+    // interpolate log10(partition function) at the location given by
+    // index, returning the value and the slope with respect to T9
+
+    template <typename T>
+    AMREX_GPU_HOST_DEVICE AMREX_INLINE
+    void interpolate_log_pf(const pf_index_t& index, const T& pf_array,
+                            amrex::Real& log10_pf, amrex::Real& slope) {{
+
+        if (index.idx >= 0) {{
+
+            // construct the slope -- this is (log10(pf_{{i+1}}) - log10(pf_i)) / (T_{{i+1}} - T_i)
+
+            slope = (pf_array{ip1} - pf_array{i}) * index.dt9_inv;
+            log10_pf = pf_array{i} + slope * index.dt9;
+
+        }} else {{
+
+            // T < the smallest T or >= the largest T in the partition function table
+            log10_pf = 0.0_rt;
+            slope = 0.0_rt;
+
+        }}
+
+    }}
+
+    // convert log10(partition function) and its slope into the
+    // partition function and its derivative with respect to T (not T9)
+
+    AMREX_GPU_HOST_DEVICE AMREX_INLINE
+    void pf_from_log_pf(const amrex::Real log10_pf, const amrex::Real slope,
+                        amrex::Real& pf, amrex::Real& dpf_dT) {{
+
+        pf = std::pow(10.0_rt, log10_pf);
+
+        amrex::Real dpf_dT9 = pf * M_LN10 * slope;
+        dpf_dT = dpf_dT9 / 1.e9_rt;
+
+    }}
+
+    // interpolation routine
+
+    template <typename T>
+    AMREX_GPU_HOST_DEVICE AMREX_INLINE
+    void interpolate_pf(const pf_index_t& index, const T& pf_array,
+                        amrex::Real& pf, amrex::Real& dpf_dT) {{
+
+        amrex::Real log10_pf;
+        amrex::Real slope;
+
+        interpolate_log_pf(index, pf_array, log10_pf, slope);
+        pf_from_log_pf(log10_pf, slope, pf, dpf_dT);
+
+    }}
+
+{interp_sig}
+        interpolate_pf(get_pf_index(t9, temp_array), pf_array, pf, dpf_dT);
+
+    }}
+
+    struct pf_cache_t {{
+        // Store the coefficient and derivative adjacent in memory, as they're
+        // always accessed at the same time.
+{cache_data}
+
+        // the partition functions for all species are filled together
+        // on first use
+        bool filled{{false}};
+    }};
+
+}}
+"""
+
+PF_CACHED_OLD = """AMREX_GPU_HOST_DEVICE AMREX_INLINE
+void get_partition_function_cached(const int inuc, const tf_t& tfactors,
+                                   part_fun::pf_cache_t& pf_cache,
+                                   amrex::Real& pf, amrex::Real& dpf_dT) {
+    if (pf_cache.data(inuc, 1) != 0.0_rt) {
+        // present in cache
+        amrex::ignore_unused(tfactors);
+        pf = pf_cache.data(inuc, 1);
+        dpf_dT = pf_cache.data(inuc, 2);
+    } else {
+        get_partition_function(inuc, tfactors, pf, dpf_dT);
+        pf_cache.data(inuc, 1) = pf;
+        pf_cache.data(inuc, 2) = dpf_dT;
+    }
+}
+"""
+
+PF_CACHED_NEW = """// fill the partition functions for all species at once -- the
+// temperature is located in the T9 grid only once
+
+AMREX_GPU_HOST_DEVICE AMREX_INLINE
+void fill_partition_functions([[maybe_unused]] const tf_t& tfactors, part_fun::pf_cache_t& pf_cache) {{
+
+    amrex::Array1D<amrex::Real, 1, NumSpecTotal> log10_pf;
+    amrex::Array1D<amrex::Real, 1, NumSpecTotal> slope;
+
+    for (int n = 1; n <= NumSpecTotal; ++n) {{
+        log10_pf(n) = 0.0_rt;
+        slope(n) = 0.0_rt;
+    }}
+{fill}
+    for (int n = 1; n <= NumSpecTotal; ++n) {{
+        part_fun::pf_from_log_pf(log10_pf(n), slope(n), pf_cache.data(n, 1), pf_cache.data(n, 2));
+    }}
+
+    pf_cache.filled = true;
+
+}}
+
+AMREX_GPU_HOST_DEVICE AMREX_INLINE
+void get_partition_function_cached(const int inuc, const tf_t& tfactors,
+                                   part_fun::pf_cache_t& pf_cache,
+                                   amrex::Real& pf, amrex::Real& dpf_dT) {{
+    if (!pf_cache.filled) {{
+        fill_partition_functions(tfactors, pf_cache);
+    }}
+
+    pf = pf_cache.data(inuc, 1);
+    dpf_dT = pf_cache.data(inuc, 2);
+}}
+"""
+
+PF_CASE_RE = re.compile(r"    case (\w+):\n"
+                        r"        part_fun::interpolate_pf(?:<part_fun::npts_\d+>)?"
+                        r"\(tfactors\.T9, part_fun::(temp_array_\d+), part_fun::(\w+), pf, dpf_dT\);\n")
+
+
+def share_pf_index(net_dir):
+    """locate the temperature in each partition function T9 grid once
+    and fill the partition functions for all species together"""
+
+    pf_file = net_dir / "partition_functions.H"
+    if not pf_file.is_file():
+        return
+
+    s = pf_file.read_text()
+
+    if PF_CACHED_OLD not in s:
+        return
+
+    if INTERP_CARR in s:
+        interp_sig = INTERP_CARR
+        index_code = PF_INDEX_CARR
+        elem = {"i": "[index.idx]", "ip1": "[index.idx+1]"}
+    else:
+        interp_sig = INTERP_ARR1D
+        index_code = PF_INDEX_ARR1D
+        elem = {"i": "(index.idx)", "ip1": "(index.idx+1)"}
+
+    # replace the interpolation routine (through the end of the
+    # part_fun namespace)
+    if s.count(interp_sig) != 1:
+        raise ValueError(f"{pf_file}: could not find interpolate_pf")
+    ibegin = s.index(interp_sig)
+    iend = s.index("\n}\n", ibegin) + len("\n}\n")
+    cache_data = re.search(r"\n( +amrex::Array2D<[^\n]*> data\{\};)\n", s[ibegin:iend]).group(1)
+    s = s[:ibegin] + index_code + PF_INTERP.format(interp_sig=interp_sig, cache_data=cache_data, **elem) + s[iend:]
+
+    # fill all the species at once, locating T9 in each distinct
+    # temperature grid only once
+    cases = PF_CASE_RE.findall(s)
+
+    grids = []
+    for _, grid, _ in cases:
+        if grid not in grids:
+            grids.append(grid)
+
+    fill = ""
+    if cases:
+        fill += "\n"
+        for grid in grids:
+            n = grid.split("_")[-1]
+            fill += f"    const part_fun::pf_index_t index_{n} = part_fun::get_pf_index(tfactors.T9, part_fun::{grid});\n"
+        fill += "\n"
+        for spec, grid, pf_array in cases:
+            n = grid.split("_")[-1]
+            fill += f"    part_fun::interpolate_log_pf(index_{n}, part_fun::{pf_array}, log10_pf({spec}), slope({spec}));\n"
+
+    s = replace_once(s, PF_CACHED_OLD, PF_CACHED_NEW.format(fill=fill), pf_file)
+    pf_file.write_text(s)
+
+
+# ---------------------------------------------------------------------
+# screening
+# ---------------------------------------------------------------------
+
+SCREEN_HEAD_OLD = """    // Evaluate screening factors
+
+    amrex::Real ratraw, dratraw_dT;
+    amrex::Real scor, dscor_dt;
+    [[maybe_unused]] amrex::Real scor2, dscor2_dt;
+"""
+
+SCREEN_HEAD_NEW = """    // Evaluate the screening factors for each unique pair of nuclei
+    // once, and then apply them to the rates
+
+    amrex::Array1D<amrex::Real, 1, ScreenPairs::nscreen> scor;
+    amrex::Array1D<amrex::Real, 1, ScreenPairs::nscreen> dscor_dt;
+
+    actual_screen(pstate, ScreenPairs::scn_facs, scor, dscor_dt);
+
+    amrex::Real ratraw, dratraw_dT;
+
+"""
+
+SCREEN_BLOCK_RE = re.compile(r"""    \{
+        constexpr auto scn_fac = scrn::calculate_screen_factor\(([^)]*)\);\n\n\n"""
+                             r"""        static_assert\(scn_fac\.z1 == [^)]*\);\n\n\n"""
+                             r"""        actual_screen\(pstate, scn_fac, scor, dscor_dt\);
+    \}
+|    \{
+        constexpr auto scn_fac2 = scrn::calculate_screen_factor\(([^)]*)\);\n\n\n"""
+                             r"""        static_assert\(scn_fac2\.z1 == [^)]*\);\n\n\n"""
+                             r"""        actual_screen\(pstate, scn_fac2, scor2, dscor2_dt\);\n
+    \}
+""")
+
+SCREEN_PAIRS_HEADER = """#ifndef actual_screen_pairs_H
+#define actual_screen_pairs_H
+
+#include <AMReX_Array.H>
+
+#include <screen_data.H>
+
+// the unique pairs of nuclei screened in evaluate_rates().  The
+// screening factors are defined in actual_network_data.cpp, so they
+// are not a local array on the stack of every RHS call.
+
+namespace ScreenPairs
+{{
+    constexpr int nscreen = {nscreen};
+
+    extern AMREX_GPU_MANAGED amrex::Array1D<scrn::screen_factors_t, 1, nscreen> scn_facs;
+}}
+
+#endif
+"""
+
+
+def dedup_screening(net_dir):
+    """screen each unique pair of nuclei once, with a single call to
+    actual_screen() for all of the pairs"""
+
+    rhs_file = net_dir / "actual_rhs.H"
+    s = rhs_file.read_text()
+
+    if SCREEN_HEAD_OLD not in s:
+        return
+
+    # the screening is either wrapped in #ifdef SCREENING or (if the
+    # network requires screening) done unconditionally
+    has_ifdef = "#ifdef SCREENING\n" + SCREEN_HEAD_OLD in s
+
+    ibegin = s.index(SCREEN_HEAD_OLD)
+    if has_ifdef:
+        iend = s.index("\n#endif\n", ibegin)
+    else:
+        iend = s.index("\n\n    // Fill approximate rates", ibegin)
+    body = s[ibegin + len(SCREEN_HEAD_OLD):iend]
+
+    pairs = []
+
+    def pair_index(args):
+        if args not in pairs:
+            pairs.append(args)
+        return pairs.index(args) + 1
+
+    # each screening block is replaced by an index into the screening
+    # factors evaluated for the unique pairs
+    chunks = []
+    pos = 0
+    cur = cur2 = None
+    for m in SCREEN_BLOCK_RE.finditer(body):
+        chunks.append((body[pos:m.start()], cur, cur2))
+        if m.group(1) is not None:
+            cur = pair_index(m.group(1))
+            cur2 = None
+        else:
+            cur2 = pair_index(m.group(2))
+        pos = m.end()
+    chunks.append((body[pos:], cur, cur2))
+
+    new_body = ""
+    for text, c1, c2 in chunks:
+        if c2 is not None:
+            text = re.sub(r"\bscor2\b", f"scor({c2})", text)
+            text = re.sub(r"\bdscor2_dt\b", f"dscor_dt({c2})", text)
+        if c1 is not None:
+            text = re.sub(r"\bscor\b(?!\()", f"scor({c1})", text)
+            text = re.sub(r"\bdscor_dt\b(?!\()", f"dscor_dt({c1})", text)
+        if "scor2" in text or re.search(r"\bscor\b(?!\()", text):
+            raise ValueError(f"{rhs_file}: unexpected use of the screening factors")
+        new_body += text
+
+    # tidy up the blank lines left behind by the removed blocks
+    new_body = re.sub(r"\n{3,}", "\n\n", new_body).lstrip("\n")
+
+    s = s[:ibegin] + SCREEN_HEAD_NEW + new_body.rstrip("\n") + ("\n" if has_ifdef else "\n\n") + s[iend:]
+    s = insert_after(s, "#include <screen.H>\n", "#include <actual_screen_pairs.H>\n", rhs_file)
+    rhs_file.write_text(s)
+
+    (net_dir / "actual_screen_pairs.H").write_text(SCREEN_PAIRS_HEADER.format(nscreen=len(pairs)))
+
+    # the screening factors themselves
+    data_file = net_dir / "actual_network_data.cpp"
+    s = data_file.read_text()
+
+    include = "#include <actual_screen_pairs.H>\n"
+    defn = "namespace ScreenPairs\n{\n"
+    defn += "    AMREX_GPU_MANAGED amrex::Array1D<scrn::screen_factors_t, 1, nscreen> scn_facs {{\n"
+    defn += ",\n".join(f"        scrn::calculate_screen_factor({p})" for p in pairs)
+    defn += "\n    }};\n}\n"
+    if has_ifdef:
+        include = "#ifdef SCREENING\n" + include + "#endif\n"
+        defn = "#ifdef SCREENING\n" + defn + "#endif\n"
+
+    s = insert_after(s, "#include <actual_network.H>\n", include, data_file)
+    s = replace_once(s, "void actual_network_init()", defn + "\nvoid actual_network_init()", data_file)
+    data_file.write_text(s)
+
+    make_file = net_dir / "Make.package"
+    s = make_file.read_text()
+    s = insert_after(s, "  CEXE_headers += actual_rhs.H\n",
+                     "  CEXE_headers += actual_screen_pairs.H\n", make_file)
+    make_file.write_text(s)
+
+
+# ---------------------------------------------------------------------
+# weak rate tables
+# ---------------------------------------------------------------------
+
+TABLE_STORE_DEFS = """
+// Almost all of the tables are tabulated on the same (rhoY, T)
+// grid.  As the tables are read in, we compare each table's grid to
+// the shared grid (taken from the first table read).  For the tables
+// that use the shared grid, the bracketing indices and interpolation
+// weights are computed once per evaluation (see tab_index_t) and
+// reused for every table.  If an axis of the shared grid is uniform,
+// we locate the point by direct indexing instead of a binary search.
+
+const int shared_nrhoy = {nrhoy};
+const int shared_ntemp = {ntemp};
+
+struct tab_grid_t
+{{
+    int initialized;
+    int rhoy_uniform;
+    int temp_uniform;
+    amrex::Real rhoy_dinv;
+    amrex::Real temp_dinv;
+    int nstored;
+}};
+
+// The tables on the shared grid are also packed into a single
+// contiguous store, laid out as [grid point][table][variable] (with
+// the variable index fastest).  Only the quantities needed by the RHS
+// are kept.  For a given grid point, the values for all of the tables
+// are adjacent in memory, so the corners of the bracketing zone can
+// be interpolated for every table in a single unit-stride loop.
+
+enum StoreVars : std::uint8_t
+{{
+    jstore_rate   = 1,
+    jstore_nuloss = 2,
+    jstore_gamma  = 3,
+    num_store_vars = jstore_gamma
+}};
+
+const int shared_ngrid = shared_nrhoy * shared_ntemp;
+const int num_store_entries = num_tables * num_store_vars;
+
+// index into the store for a given table slot and variable
+AMREX_INLINE AMREX_GPU_HOST_DEVICE
+constexpr int store_entry(const int slot, const int var)
+{{
+    return (slot - 1) * num_store_vars + var;
+}}
+
+// index into the store for a grid point (rhoY is fastest)
+AMREX_INLINE AMREX_GPU_HOST_DEVICE
+constexpr int store_point(const int irhoy, const int jtemp)
+{{
+    return irhoy + (jtemp - 1) * shared_nrhoy;
+}}
+"""
+
+TABLE_STORE_EXTERNS = """    extern AMREX_GPU_MANAGED tab_grid_t shared_grid_meta;
+    extern AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, shared_nrhoy> shared_rhoy;
+    extern AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, shared_ntemp> shared_temp;
+
+    extern AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, num_store_entries, 1, shared_ngrid> table_store;
+
+"""
+
+INIT_TAB_INFO_OLD = """template <typename R, typename T, typename D>
+void init_tab_info(const table_t& tf, const std::string& file, R& log_rhoy_table, T& log_temp_table, D& data)
+{
+    // This function initializes the selected tabular-rate tables. From the tables we are interested
+    // on the rate, neutrino-energy-loss and the gamma-energy entries.
+
+    std::ifstream table;
+    table.open(file);
+
+    if (!table.is_open()) {
+        // the table was not present or we could not open it; abort
+        amrex::Error("table could not be opened");
+    }
+
+    std::string line;
+
+    // read and skip over the header
+
+    for (int i = 0; i < tf.nheader; ++i) {
+        std::getline(table, line);
+    }
+
+    // now the data -- there are 2 extra columns, for log_temp and log_rhoy
+
+    for (int j = 1; j <= tf.nrhoy; ++j) {
+        for (int i = 1; i <= tf.ntemp; ++i) {
+            std::getline(table, line);
+            if (line.empty()) {
+                amrex::Error("Error reading table data");
+            }
+
+            std::istringstream sdata(line);
+
+            sdata >> log_rhoy_table(j) >> log_temp_table(i);
+
+            for (int n = 1; n <= tf.nvars; ++n) {
+                sdata >> data(i, j, n);
+            }
+        }
+    }
+    table.close();
+}
+"""
+
+INIT_TAB_INFO_NEW = """template <typename R, typename T>
+bool register_table_grid(const table_t& tf, const R& log_rhoy_table, const T& log_temp_table)
+{
+    // Check whether this table's grid matches the shared grid.  The
+    // first table read in defines the shared grid.
+
+    using namespace rate_tables;
+
+    if (tf.nrhoy != shared_nrhoy || tf.ntemp != shared_ntemp) {
+        return false;
+    }
+
+    if (! shared_grid_meta.initialized) {
+        for (int j = 1; j <= shared_nrhoy; ++j) {
+            shared_rhoy(j) = log_rhoy_table(j);
+        }
+        for (int i = 1; i <= shared_ntemp; ++i) {
+            shared_temp(i) = log_temp_table(i);
+        }
+        shared_grid_meta.initialized = 1;
+        return true;
+    }
+
+    for (int j = 1; j <= shared_nrhoy; ++j) {
+        if (log_rhoy_table(j) != shared_rhoy(j)) {
+            return false;
+        }
+    }
+
+    for (int i = 1; i <= shared_ntemp; ++i) {
+        if (log_temp_table(i) != shared_temp(i)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename V>
+bool grid_is_uniform(const int vlen, const V& vector, amrex::Real& dinv)
+{
+    // Determine if the grid is uniformly spaced, to a relative
+    // tolerance that allows for the precision of the tabulated values.
+
+    const amrex::Real dx = (vector(vlen) - vector(1)) / static_cast<amrex::Real>(vlen - 1);
+
+    for (int i = 1; i < vlen; ++i) {
+        if (std::abs((vector(i+1) - vector(i)) - dx) > 1.e-6_rt * std::abs(dx)) {
+            return false;
+        }
+    }
+
+    dinv = 1.0_rt / dx;
+    return true;
+}
+
+inline void finalize_shared_grid()
+{
+    using namespace rate_tables;
+
+    if (! shared_grid_meta.initialized) {
+        return;
+    }
+
+    shared_grid_meta.rhoy_uniform = grid_is_uniform(shared_nrhoy, shared_rhoy, shared_grid_meta.rhoy_dinv);
+    shared_grid_meta.temp_uniform = grid_is_uniform(shared_ntemp, shared_temp, shared_grid_meta.temp_dinv);
+}
+
+template <typename R, typename T, typename D>
+void init_tab_info(table_t& tf, const std::string& file, R& log_rhoy_table, T& log_temp_table, D& data)
+{
+    // This function initializes the selected tabular-rate tables. From the tables we are interested
+    // on the rate, neutrino-energy-loss and the gamma-energy entries.
+
+    // use the binary blob if it has this table, otherwise parse the text file
+
+    weak_rate_blob::table_view_t view;
+
+    if (weak_rate_blob::find(file, view) &&
+        view.ntemp == tf.ntemp && view.nrhoy == tf.nrhoy && view.nvars == tf.nvars) {
+
+        for (int j = 1; j <= tf.nrhoy; ++j) {
+            log_rhoy_table(j) = view.log_rhoy[j-1];
+        }
+
+        for (int i = 1; i <= tf.ntemp; ++i) {
+            log_temp_table(i) = view.log_temp[i-1];
+        }
+
+        for (int n = 1; n <= tf.nvars; ++n) {
+            for (int j = 1; j <= tf.nrhoy; ++j) {
+                for (int i = 1; i <= tf.ntemp; ++i) {
+                    data(i, j, n) = view.data[(i-1) + tf.ntemp * ((j-1) + tf.nrhoy * (n-1))];
+                }
+            }
+        }
+
+    } else {
+
+        std::ifstream table;
+        table.open(file);
+
+        if (!table.is_open()) {
+            // the table was not present or we could not open it; abort
+            amrex::Error("table could not be opened");
+        }
+
+        std::string line;
+
+        // read and skip over the header
+
+        for (int i = 0; i < tf.nheader; ++i) {
+            std::getline(table, line);
+        }
+
+        // now the data -- there are 2 extra columns, for log_temp and log_rhoy
+
+        for (int j = 1; j <= tf.nrhoy; ++j) {
+            for (int i = 1; i <= tf.ntemp; ++i) {
+                std::getline(table, line);
+                if (line.empty()) {
+                    amrex::Error("Error reading table data");
+                }
+
+                std::istringstream sdata(line);
+
+                sdata >> log_rhoy_table(j) >> log_temp_table(i);
+
+                for (int n = 1; n <= tf.nvars; ++n) {
+                    sdata >> data(i, j, n);
+                }
+            }
+        }
+        table.close();
+
+    }
+
+    tf.shared_grid = register_table_grid(tf, log_rhoy_table, log_temp_table);
+
+    // pack the table into the shared store
+
+    tf.store_index = 0;
+
+    if (tf.shared_grid) {
+        using namespace rate_tables;
+
+        tf.store_index = ++shared_grid_meta.nstored;
+
+        for (int j = 1; j <= tf.nrhoy; ++j) {
+            for (int i = 1; i <= tf.ntemp; ++i) {
+                const int g = store_point(j, i);
+                table_store(store_entry(tf.store_index, jstore_rate), g) = data(i, j, jtab_rate);
+                table_store(store_entry(tf.store_index, jstore_nuloss), g) = data(i, j, jtab_nuloss);
+                table_store(store_entry(tf.store_index, jstore_gamma), g) = data(i, j, jtab_gamma);
+            }
+        }
+    }
+}
+"""
+
+TABLE_STORE_EVAL = """// The bracketing indices and interpolation weights on the shared
+// grid for a single (rhoY, T) point.  These are computed once per
+// evaluation by get_tab_index() and then used for all of the tables
+// that are on the shared grid.
+
+struct tab_index_t
+{
+    amrex::Real rhoy;
+    amrex::Real temp;
+    amrex::Real log_rhoy;
+    amrex::Real log_temp;
+
+    // lower bracketing indices into the shared grid
+    int irhoy;
+    int jtemp;
+
+    // linear interpolation weights of the upper point (the point is
+    // clamped to the bracketing zone, as in evaluate_linear_2d)
+    amrex::Real wrhoy;
+    amrex::Real wtemp;
+
+    // data for the temperature derivative (see evaluate_dr_dtemp)
+    int dtemp_interior;
+    int temp_in_zone;
+    amrex::Real dtemp_inv;
+    amrex::Real dtemp_c_j_inv;
+    amrex::Real dtemp_c_jp1_inv;
+};
+
+
+AMREX_INLINE AMREX_GPU_HOST_DEVICE
+tab_index_t
+get_tab_index(const amrex::Real rhoy, const amrex::Real temp)
+{
+    using namespace rate_tables;
+
+    tab_index_t idx{};
+
+    idx.rhoy = rhoy;
+    idx.temp = temp;
+    idx.log_rhoy = std::log10(rhoy);
+    idx.log_temp = std::log10(temp);
+
+    if (! shared_grid_meta.initialized) {
+        return idx;
+    }
+
+    // locate the point -- directly if the grid is uniform, otherwise
+    // with a single binary search
+
+    if (shared_grid_meta.rhoy_uniform) {
+        amrex::Real x = (idx.log_rhoy - shared_rhoy(1)) * shared_grid_meta.rhoy_dinv;
+        x = amrex::Clamp(x, 0.0_rt, static_cast<amrex::Real>(shared_nrhoy));
+        idx.irhoy = amrex::Clamp(static_cast<int>(x) + 1, 1, shared_nrhoy - 1);
+    } else {
+        idx.irhoy = vector_index_lu(shared_nrhoy, shared_rhoy, idx.log_rhoy);
+    }
+
+    if (shared_grid_meta.temp_uniform) {
+        amrex::Real x = (idx.log_temp - shared_temp(1)) * shared_grid_meta.temp_dinv;
+        x = amrex::Clamp(x, 0.0_rt, static_cast<amrex::Real>(shared_ntemp));
+        idx.jtemp = amrex::Clamp(static_cast<int>(x) + 1, 1, shared_ntemp - 1);
+    } else {
+        idx.jtemp = vector_index_lu(shared_ntemp, shared_temp, idx.log_temp);
+    }
+
+    const int i = idx.irhoy;
+    const int j = idx.jtemp;
+
+    const amrex::Real rhoy_lo = shared_rhoy(i);
+    const amrex::Real rhoy_hi = shared_rhoy(i+1);
+    const amrex::Real t_lo = shared_temp(j);
+    const amrex::Real t_hi = shared_temp(j+1);
+
+    idx.wrhoy = (amrex::Clamp(idx.log_rhoy, rhoy_lo, rhoy_hi) - rhoy_lo) / (rhoy_hi - rhoy_lo);
+    idx.wtemp = (amrex::Clamp(idx.log_temp, t_lo, t_hi) - t_lo) / (t_hi - t_lo);
+
+    idx.dtemp_inv = 1.0_rt / (t_hi - t_lo);
+    idx.temp_in_zone = (idx.log_temp >= t_lo) && (idx.log_temp <= t_hi);
+
+    idx.dtemp_interior = (j - 1 >= 1) && (j + 2 <= shared_ntemp);
+    if (idx.dtemp_interior) {
+        idx.dtemp_c_j_inv = 1.0_rt / (t_hi - shared_temp(j-1));
+        idx.dtemp_c_jp1_inv = 1.0_rt / (shared_temp(j+2) - t_lo);
+    }
+
+    return idx;
+}
+
+
+AMREX_INLINE AMREX_GPU_HOST_DEVICE
+amrex::Real
+evaluate_bilinear(const tab_index_t& idx,
+                  const amrex::Real fij, const amrex::Real fip1j,
+                  const amrex::Real fijp1, const amrex::Real fip1jp1)
+{
+    // i is the rhoY index and j is the temperature index
+
+    return (1.0_rt - idx.wtemp) * ((1.0_rt - idx.wrhoy) * fij + idx.wrhoy * fip1j) +
+           idx.wtemp * ((1.0_rt - idx.wrhoy) * fijp1 + idx.wrhoy * fip1jp1);
+}
+
+
+template <typename R, typename T, typename D>
+AMREX_INLINE AMREX_GPU_HOST_DEVICE
+void
+tabular_evaluate(const table_t& table_meta,
+                 const R& log_rhoy_table, const T& log_temp_table, const D& data,
+                 const tab_index_t& idx,
+                 amrex::Real& rate, amrex::Real& drate_dt, amrex::Real& edot_nu, amrex::Real& edot_gamma)
+{
+    // Evaluate a table using the precomputed indices and weights on
+    // the shared grid.  Tables that are not on the shared grid fall
+    // back to searching their own grid.
+
+    if (! table_meta.shared_grid) {
+        tabular_evaluate(table_meta, log_rhoy_table, log_temp_table, data,
+                         idx.rhoy, idx.temp, rate, drate_dt, edot_nu, edot_gamma);
+        return;
+    }
+
+    const int i = idx.irhoy;
+    const int j = idx.jtemp;
+
+    const amrex::Real log_rate = evaluate_bilinear(idx,
+                                                   data(j, i, jtab_rate), data(j, i+1, jtab_rate),
+                                                   data(j+1, i, jtab_rate), data(j+1, i+1, jtab_rate));
+
+    const amrex::Real log_nuloss = evaluate_bilinear(idx,
+                                                     data(j, i, jtab_nuloss), data(j, i+1, jtab_nuloss),
+                                                     data(j+1, i, jtab_nuloss), data(j+1, i+1, jtab_nuloss));
+
+    const amrex::Real log_gamma = evaluate_bilinear(idx,
+                                                    data(j, i, jtab_gamma), data(j, i+1, jtab_gamma),
+                                                    data(j+1, i, jtab_gamma), data(j+1, i+1, jtab_gamma));
+
+    // d log(rate) / d log(T), using the same stencils as evaluate_dr_dtemp
+
+    amrex::Real dlogr_dlogt;
+
+    if (idx.dtemp_interior) {
+        const amrex::Real dlogr_dlogt_ij     = (data(j+1, i, jtab_rate) - data(j-1, i, jtab_rate)) * idx.dtemp_c_j_inv;
+        const amrex::Real dlogr_dlogt_ijp1   = (data(j+2, i, jtab_rate) - data(j, i, jtab_rate)) * idx.dtemp_c_jp1_inv;
+        const amrex::Real dlogr_dlogt_ip1j   = (data(j+1, i+1, jtab_rate) - data(j-1, i+1, jtab_rate)) * idx.dtemp_c_j_inv;
+        const amrex::Real dlogr_dlogt_ip1jp1 = (data(j+2, i+1, jtab_rate) - data(j, i+1, jtab_rate)) * idx.dtemp_c_jp1_inv;
+
+        dlogr_dlogt = evaluate_bilinear(idx, dlogr_dlogt_ij, dlogr_dlogt_ip1j,
+                                        dlogr_dlogt_ijp1, dlogr_dlogt_ip1jp1);
+    } else if (idx.temp_in_zone) {
+        const amrex::Real dlogr_dlogt_i   = (data(j+1, i, jtab_rate) - data(j, i, jtab_rate)) * idx.dtemp_inv;
+        const amrex::Real dlogr_dlogt_ip1 = (data(j+1, i+1, jtab_rate) - data(j, i+1, jtab_rate)) * idx.dtemp_inv;
+
+        dlogr_dlogt = (1.0_rt - idx.wrhoy) * dlogr_dlogt_i + idx.wrhoy * dlogr_dlogt_ip1;
+    } else {
+        dlogr_dlogt = 0.0_rt;
+    }
+
+    rate       = std::pow(10.0_rt, log_rate);
+    drate_dt   = rate * dlogr_dlogt / idx.temp;
+    edot_nu    = -std::pow(10.0_rt, log_nuloss);
+    edot_gamma = std::pow(10.0_rt, log_gamma);
+}
+
+// The interpolated values for every table in the store at a single
+// (rhoY, T) point.
+
+struct tab_store_eval_t
+{
+    // log10 of the rate, neutrino loss, and gamma energy, indexed by
+    // store_entry(slot, var)
+    amrex::Array1D<amrex::Real, 1, num_store_entries> log_vars;
+
+    // d log(rate) / d log(T), indexed by slot
+    amrex::Array1D<amrex::Real, 1, num_tables> dlogr_dlogt;
+};
+
+
+AMREX_INLINE AMREX_GPU_HOST_DEVICE
+void
+evaluate_table_store(const tab_index_t& idx, tab_store_eval_t& tab_eval)
+{
+    // Interpolate all of the tables in the store at once, using the
+    // shared bracketing indices and weights.
+
+    using namespace rate_tables;
+
+    const int nslots = shared_grid_meta.nstored;
+
+    if (nslots == 0) {
+        return;
+    }
+
+    const int i = idx.irhoy;
+    const int j = idx.jtemp;
+
+    const int gij     = store_point(i, j);
+    const int gip1j   = store_point(i+1, j);
+    const int gijp1   = store_point(i, j+1);
+    const int gip1jp1 = store_point(i+1, j+1);
+
+    const amrex::Real wij     = (1.0_rt - idx.wtemp) * (1.0_rt - idx.wrhoy);
+    const amrex::Real wip1j   = (1.0_rt - idx.wtemp) * idx.wrhoy;
+    const amrex::Real wijp1   = idx.wtemp * (1.0_rt - idx.wrhoy);
+    const amrex::Real wip1jp1 = idx.wtemp * idx.wrhoy;
+
+    // the values -- this is a unit-stride loop over [table][variable]
+    // for each of the four corners
+
+    const int nentries = nslots * num_store_vars;
+
+    for (int k = 1; k <= nentries; ++k) {
+        tab_eval.log_vars(k) = wij * table_store(k, gij) + wip1j * table_store(k, gip1j) +
+                               wijp1 * table_store(k, gijp1) + wip1jp1 * table_store(k, gip1jp1);
+    }
+
+    // d log(rate) / d log(T), using the same stencils as evaluate_dr_dtemp
+
+    if (idx.dtemp_interior) {
+        const int gijm1   = store_point(i, j-1);
+        const int gip1jm1 = store_point(i+1, j-1);
+        const int gijp2   = store_point(i, j+2);
+        const int gip1jp2 = store_point(i+1, j+2);
+
+        for (int n = 1; n <= nslots; ++n) {
+            const int k = store_entry(n, jstore_rate);
+
+            const amrex::Real dlogr_dlogt_ij     = (table_store(k, gijp1) - table_store(k, gijm1)) * idx.dtemp_c_j_inv;
+            const amrex::Real dlogr_dlogt_ijp1   = (table_store(k, gijp2) - table_store(k, gij)) * idx.dtemp_c_jp1_inv;
+            const amrex::Real dlogr_dlogt_ip1j   = (table_store(k, gip1jp1) - table_store(k, gip1jm1)) * idx.dtemp_c_j_inv;
+            const amrex::Real dlogr_dlogt_ip1jp1 = (table_store(k, gip1jp2) - table_store(k, gip1j)) * idx.dtemp_c_jp1_inv;
+
+            tab_eval.dlogr_dlogt(n) = wij * dlogr_dlogt_ij + wip1j * dlogr_dlogt_ip1j +
+                                      wijp1 * dlogr_dlogt_ijp1 + wip1jp1 * dlogr_dlogt_ip1jp1;
+        }
+    } else if (idx.temp_in_zone) {
+        for (int n = 1; n <= nslots; ++n) {
+            const int k = store_entry(n, jstore_rate);
+
+            const amrex::Real dlogr_dlogt_i   = (table_store(k, gijp1) - table_store(k, gij)) * idx.dtemp_inv;
+            const amrex::Real dlogr_dlogt_ip1 = (table_store(k, gip1jp1) - table_store(k, gip1j)) * idx.dtemp_inv;
+
+            tab_eval.dlogr_dlogt(n) = (1.0_rt - idx.wrhoy) * dlogr_dlogt_i + idx.wrhoy * dlogr_dlogt_ip1;
+        }
+    } else {
+        for (int n = 1; n <= nslots; ++n) {
+            tab_eval.dlogr_dlogt(n) = 0.0_rt;
+        }
+    }
+}
+
+
+template <typename R, typename T, typename D>
+AMREX_INLINE AMREX_GPU_HOST_DEVICE
+void
+tabular_evaluate(const table_t& table_meta,
+                 const R& log_rhoy_table, const T& log_temp_table, const D& data,
+                 const tab_index_t& idx, const tab_store_eval_t& tab_eval,
+                 amrex::Real& rate, amrex::Real& drate_dt, amrex::Real& edot_nu, amrex::Real& edot_gamma)
+{
+    // Get the rate for a single table from the store evaluation.
+    // Tables that are not in the store are evaluated directly.
+
+    const int n = table_meta.store_index;
+
+    if (n == 0) {
+        tabular_evaluate(table_meta, log_rhoy_table, log_temp_table, data,
+                         idx, rate, drate_dt, edot_nu, edot_gamma);
+        return;
+    }
+
+    rate       = std::pow(10.0_rt, tab_eval.log_vars(store_entry(n, jstore_rate)));
+    drate_dt   = rate * tab_eval.dlogr_dlogt(n) / idx.temp;
+    edot_nu    = -std::pow(10.0_rt, tab_eval.log_vars(store_entry(n, jstore_nuloss)));
+    edot_gamma = std::pow(10.0_rt, tab_eval.log_vars(store_entry(n, jstore_gamma)));
+}
+"""
+
+TABLE_STORE_DATA = """    AMREX_GPU_MANAGED tab_grid_t shared_grid_meta;
+    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, shared_nrhoy> shared_rhoy;
+    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, shared_ntemp> shared_temp;
+
+    AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, num_store_entries, 1, shared_ngrid> table_store;
+
+"""
+
+TABLE_READ_MSG_OLD = """    amrex::Print() << "reading in network electron-capture / beta-decay tables..." << std::endl;
+"""
+
+TABLE_READ_MSG_NEW = """    const bool have_blob = weak_rate_blob::open(network_rp::weak_rate_blob_file);
+
+    if (have_blob) {
+        amrex::Print() << "reading in network electron-capture / beta-decay tables from "
+                       << network_rp::weak_rate_blob_file << "..." << std::endl;
+    } else {
+        amrex::Print() << "reading in network electron-capture / beta-decay tables..." << std::endl;
+    }
+"""
+
+TABLE_INDEX_RHS = """    // locate (rhoY, T) in the shared table grid once and interpolate
+    // all of the tables in the consolidated store together
+
+    const tab_index_t tab_idx = get_tab_index(rhoy, state.T);
+
+    tab_store_eval_t tab_eval;
+    evaluate_table_store(tab_idx, tab_eval);
+
+"""
+
+WEAK_RATE_BLOB_PARAM = """# binary blob of the weak rate tables (written by make_weak_rate_blob.py).
+# If it is not present or is invalid, the text tables are read instead.
+weak_rate_blob_file        string       "weak_rate_tables.bin"
+"""
+
+
+def use_weak_rate_store(net_dir):
+    """read the weak rate tables from the binary blob and interpolate
+    the tables on the shared (rhoY, T) grid together"""
+
+    table_file = net_dir / "table_rates.H"
+    s = table_file.read_text()
+
+    if INIT_TAB_INFO_OLD not in s:
+        return
+
+    data_file = net_dir / "table_rates_data.cpp"
+    d = data_file.read_text()
+
+    # the shared grid is the grid of the first table read in
+    ntemp = re.search(r"_meta\.ntemp = (\d+);", d).group(1)
+    nrhoy = re.search(r"_meta\.nrhoy = (\d+);", d).group(1)
+
+    s = insert_after(s, "#include <AMReX_Array.H>\n\n", "#include <weak_rate_blob.H>\n\n", table_file)
+    s = replace_once(s, "    int nheader;\n};\n",
+                     "    int nheader;\n    int shared_grid;\n    int store_index;\n};\n" +
+                     TABLE_STORE_DEFS.format(nrhoy=nrhoy, ntemp=ntemp), table_file)
+    s = replace_once(s, "\n}\n\n" + INIT_TAB_INFO_OLD,
+                     "\n" + TABLE_STORE_EXTERNS + "}\n\n" + INIT_TAB_INFO_NEW, table_file)
+    if not s.endswith("\n#endif\n"):
+        raise ValueError(f"{table_file}: expected the file to end with #endif")
+    s = s[:-len("#endif\n")] + TABLE_STORE_EVAL + "\n#endif\n"
+    table_file.write_text(s)
+
+    d = insert_after(d, "#include <AMReX_Print.H>\n",
+                     "#include <extern_parameters.H>\n#include <weak_rate_blob.H>\n", data_file)
+    ns_end = d.index("\n}\n", d.index("namespace rate_tables\n{\n"))
+    d = d[:ns_end] + TABLE_STORE_DATA + d[ns_end:]
+    d = replace_once(d, TABLE_READ_MSG_OLD, TABLE_READ_MSG_NEW, data_file)
+    d = insert_after(d, "    using namespace rate_tables;\n\n",
+                     "    shared_grid_meta.initialized = 0;\n    shared_grid_meta.nstored = 0;\n\n", data_file)
+    last_init = d.rindex("    init_tab_info(")
+    last_init = d.index("\n", last_init) + 1
+    d = d[:last_init] + "\n    finalize_shared_grid();\n\n    weak_rate_blob::close();\n" + d[last_init:]
+    data_file.write_text(d)
+
+    rhs_file = net_dir / "actual_rhs.H"
+    s = rhs_file.read_text()
+    s = replace_once(s, "    rate_eval.enuc_weak = 0.0_rt;\n\n    tabular_evaluate(",
+                     "    rate_eval.enuc_weak = 0.0_rt;\n\n" + TABLE_INDEX_RHS + "    tabular_evaluate(",
+                     rhs_file)
+    s = insert_after(s, "    // Calculate tabular rates and get ydot_weak\n\n",
+                     TABLE_INDEX_RHS.split("\n\n", 1)[1], rhs_file)
+    s = s.replace("rhoy, state.T, rate, drate_dt, edot_nu, edot_gamma);",
+                  "tab_idx, tab_eval, rate, drate_dt, edot_nu, edot_gamma);")
+    rhs_file.write_text(s)
+
+    make_file = net_dir / "Make.package"
+    s = make_file.read_text()
+    s = insert_after(s, "  CEXE_sources += table_rates_data.cpp\n",
+                     "  CEXE_headers += weak_rate_blob.H\n"
+                     "  CEXE_sources += weak_rate_blob.cpp\n", make_file)
+    make_file.write_text(s)
+
+    param_file = net_dir / "_parameters"
+    s = param_file.read_text()
+    param_file.write_text(s + WEAK_RATE_BLOB_PARAM)
+
+
+def postprocess(net_dir):
+    """apply all of the changes to the network in net_dir"""
+
+    net_dir = Path(net_dir)
+
+    use_reaclib_rate_tables(net_dir)
+    share_pf_index(net_dir)
+    dedup_screening(net_dir)
+    if net_dir.name in WEAK_RATE_STORE_NETWORKS:
+        use_weak_rate_store(net_dir)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    for d in sys.argv[1:]:
+        postprocess(d)
@@ -0,0 +1,109 @@
+#include <cmath>
+#include <string>
+
+#include <AMReX_Print.H>
+
+#include <reaclib_rate_tables.H>
+
+namespace reaclib_tables
+{
+    AMREX_GPU_MANAGED amrex::Array3D<amrex::Real, 1, 2, 1, Rates::NrateReaclib, 1, ntab> ln_rate_tab;
+}
+
+
+void reaclib_tables::init_reaclib_tables()
+{
+
+    amrex::Print() << "tabulating ReacLib rates..." << std::endl;
+
+    for (int i = 1; i <= ntab; ++i) {
+
+        const amrex::Real lnT = lnT_lo + static_cast<amrex::Real>(i-1) * dlnT;
+        const amrex::Real temp = std::exp(lnT);
+
+        tf_t tfactors = evaluate_tfactors(temp);
+
+        rate_derivs_t rate_eval;
+        fill_reaclib_rates<1, rate_derivs_t>(tfactors, rate_eval);
+
+        for (int r = 1; r <= Rates::NrateReaclib; ++r) {
+            const amrex::Real rate = rate_eval.screened_rates(r);
+
+            if (rate > std::exp(min_ln_rate)) {
+                ln_rate_tab(1, r, i) = std::log(rate);
+                ln_rate_tab(2, r, i) = temp * rate_eval.dscreened_rates_dT(r) / rate;
+            } else {
+                ln_rate_tab(1, r, i) = min_ln_rate;
+                ln_rate_tab(2, r, i) = 0.0_rt;
+            }
+        }
+    }
+
+}
+
+
+void reaclib_tables::report_reaclib_table_accuracy()
+{
+
+    // we only consider rates that are well above the ReacLib floor,
+    // since the floor introduces a kink that the interpolant does not
+    // capture (and those rates are negligible anyway)
+
+    const amrex::Real rate_floor = std::exp(min_ln_rate + 30.0_rt);
+
+    amrex::Real max_err_rate{0.0_rt};
+    amrex::Real max_err_drate{0.0_rt};
+    amrex::Real T_err_rate{0.0_rt};
+    amrex::Real T_err_drate{0.0_rt};
+    int r_err_rate{1};
+    int r_err_drate{1};
+
+    for (int i = 1; i < ntab; ++i) {
+
+        const amrex::Real lnT = lnT_lo + (static_cast<amrex::Real>(i-1) + 0.5_rt) * dlnT;
+        const amrex::Real temp = std::exp(lnT);
+
+        tf_t tfactors = evaluate_tfactors(temp);
+
+        rate_derivs_t exact;
+        fill_reaclib_rates<1, rate_derivs_t>(tfactors, exact);
+
+        rate_derivs_t interp;
+        tabulated_reaclib_rates(temp, lnT, interp);
+
+        for (int r = 1; r <= Rates::NrateReaclib; ++r) {
+            if (exact.screened_rates(r) < rate_floor) {
+                continue;
+            }
+
+            const amrex::Real err_rate = std::abs(interp.screened_rates(r) - exact.screened_rates(r)) /
+                                         exact.screened_rates(r);
+
+            // normalize the derivative error by rate / T, so we measure
+            // the error in d ln(rate) / d ln(T)
+
+            const amrex::Real err_drate = std::abs(interp.dscreened_rates_dT(r) - exact.dscreened_rates_dT(r)) *
+                                          temp / exact.screened_rates(r);
+
+            if (err_rate > max_err_rate) {
+                max_err_rate = err_rate;
+                T_err_rate = temp;
+                r_err_rate = r;
+            }
+
+            if (err_drate > max_err_drate) {
+                max_err_drate = err_drate;
+                T_err_drate = temp;
+                r_err_drate = r;
+            }
+        }
+    }
+
+    amrex::Print() << "ReacLib rate table accuracy (" << ntab << " points in T, "
+                   << Rates::NrateReaclib << " rates):" << std::endl;
+    amrex::Print() << "  max relative error in rate:             " << max_err_rate
+                   << " (" << Rates::rate_names[r_err_rate] << ", T = " << T_err_rate << ")" << std::endl;
+    amrex::Print() << "  max absolute error in dln(rate)/dln(T): " << max_err_drate
+                   << " (" << Rates::rate_names[r_err_drate] << ", T = " << T_err_drate << ")" << std::endl;
+
+}
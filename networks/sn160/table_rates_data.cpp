@@ -2,6 +2,8 @@
 #include <string>
 #include <table_rates.H>
 #include <AMReX_Print.H>
+#include <extern_parameters.H>
+#include <weak_rate_blob.H>
 
 using namespace amrex;
 
@@ -848,6 +850,12 @@ namespace rate_tables
     AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, 11> j_Zn65_Cu65_rhoy;
     AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, 13> j_Zn65_Cu65_temp;
 
+    AMREX_GPU_MANAGED tab_grid_t shared_grid_meta;
+    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, shared_nrhoy> shared_rhoy;
+    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, shared_ntemp> shared_temp;
+
+    AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, num_store_entries, 1, shared_ngrid> table_store;
+
 
 }
 
@@ -855,10 +863,20 @@ namespace rate_tables
 void init_tabular()
 {
 
-    amrex::Print() << "reading in network electron-capture / beta-decay tables..." << std::endl;
+    const bool have_blob = weak_rate_blob::open(network_rp::weak_rate_blob_file);
+
+    if (have_blob) {
+        amrex::Print() << "reading in network electron-capture / beta-decay tables from "
+                       << network_rp::weak_rate_blob_file << "..." << std::endl;
+    } else {
+        amrex::Print() << "reading in network electron-capture / beta-decay tables..." << std::endl;
+    }
 
     using namespace rate_tables;
 
+    shared_grid_meta.initialized = 0;
+    shared_grid_meta.nstored = 0;
+
     j_Al25_Mg25_meta.ntemp = 13;
     j_Al25_Mg25_meta.nrhoy = 11;
     j_Al25_Mg25_meta.nvars = 6;
@@ -2202,6 +2220,10 @@ void init_tabular()
 
     init_tab_info(j_Zn65_Cu65_meta, "langanke-65zn-65cu_electroncapture.dat", j_Zn65_Cu65_rhoy, j_Zn65_Cu65_temp, j_Zn65_Cu65_data);
 
+    finalize_shared_grid();
+
+    weak_rate_blob::close();
+
 
 
 }
@@ -6,6 +6,8 @@ import subprocess
 import sys
 from pathlib import Path
 
+from pynucastro_postprocess import postprocess
+
 # Disable slightly-less-precise AVX-512 SVML routines to avoid roundoff diffs
 # when different machines regenerate the networks. Accuracy is important here,
 # and these calculations aren't a bottleneck. See pynucastro/conftest.py for
@@ -14,6 +16,7 @@ env = os.environ.copy()
 env["NPY_DISABLE_CPU_FEATURES"] = "AVX512F AVX512CD AVX512_SKX"
 
 cwd = Path.cwd()
+failed = False
 for net_file in sorted(cwd.glob("**/pynucastro.net")):
     network_dir = net_file.parent
 
@@ -37,6 +40,12 @@ for net_file in sorted(cwd.glob("**/pynucastro.net")):
     )
     if result.returncode != 0:
         print(f"error: python exited with status {result.returncode}")
+        failed = True
     else:
+        # apply the Microphysics changes to the generated code
+        postprocess(network_dir)
         print("updated successfully")
     print()
+
+if failed:
+    sys.exit(1)
@@ -0,0 +1,207 @@
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef WEAK_RATE_BLOB_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <AMReX.H>
+#include <AMReX_Print.H>
+
+#include <weak_rate_blob.H>
+#include <table_checksum.H>
+
+namespace
+{
+    // these need to match make_weak_rate_blob.py
+
+    constexpr char blob_magic[8] = {'M', 'P', 'W', 'K', 'R', 'A', 'T', 'E'};
+    constexpr std::uint32_t blob_version = 2;
+
+    struct blob_header_t
+    {
+        char magic[8];
+        std::uint32_t byte_order;
+        std::uint32_t version;
+        std::uint32_t ntables;
+        std::uint32_t name_len;
+        std::uint32_t directory_checksum;
+        std::uint32_t pad;
+    };
+
+    struct blob_entry_t
+    {
+        std::uint32_t ntemp;
+        std::uint32_t nrhoy;
+        std::uint32_t nvars;
+        std::uint32_t checksum;
+        std::uint64_t offset;
+    };
+
+    const unsigned char* blob_data = nullptr;
+    std::size_t blob_size = 0;
+
+#ifndef WEAK_RATE_BLOB_MMAP
+    // without mmap, we read the whole blob into memory
+    std::vector<unsigned char> blob_buffer;
+#endif
+
+    blob_header_t blob_header;
+
+    std::size_t entry_size()
+    {
+        return blob_header.name_len + sizeof(blob_entry_t);
+    }
+}
+
+
+bool weak_rate_blob::open(const std::string& filename)
+{
+
+    close();
+
+#ifdef WEAK_RATE_BLOB_MMAP
+
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(blob_header_t)) {
+        ::close(fd);
+        return false;
+    }
+
+    void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    // the mapping stays valid after the descriptor is closed
+    ::close(fd);
+
+    if (p == MAP_FAILED) {
+        return false;
+    }
+
+    blob_data = static_cast<const unsigned char*>(p);
+    blob_size = st.st_size;
+
+#else
+
+    std::ifstream blob(filename, std::ios::binary | std::ios::ate);
+    if (!blob.is_open()) {
+        return false;
+    }
+
+    const auto size = static_cast<std::size_t>(blob.tellg());
+    if (size < sizeof(blob_header_t)) {
+        return false;
+    }
+
+    blob_buffer.resize(size);
+    blob.seekg(0);
+    blob.read(reinterpret_cast<char*>(blob_buffer.data()), static_cast<std::streamsize>(size));
+
+    if (!blob.good()) {
+        blob_buffer.clear();
+        return false;
+    }
+
+    blob_data = blob_buffer.data();
+    blob_size = size;
+
+#endif
+
+    // validate the header and the directory
+
+    std::memcpy(&blob_header, blob_data, sizeof(blob_header_t));
+
+    bool valid = std::memcmp(blob_header.magic, blob_magic, sizeof(blob_magic)) == 0 &&
+                 blob_header.byte_order == table_checksum::byte_order_marker &&
+                 blob_header.version == blob_version;
+
+    if (valid) {
+        const std::size_t dir_size = blob_header.ntables * entry_size();
+        valid = sizeof(blob_header_t) + dir_size <= blob_size &&
+                table_checksum::crc32(blob_data + sizeof(blob_header_t), dir_size) == blob_header.directory_checksum;
+    }
+
+    if (!valid) {
+        amrex::Print() << "weak rate blob " << filename << " is invalid, ignoring" << std::endl;
+        close();
+        return false;
+    }
+
+    return true;
+
+}
+
+
+void weak_rate_blob::close()
+{
+
+#ifdef WEAK_RATE_BLOB_MMAP
+    if (blob_data != nullptr) {
+        munmap(const_cast<unsigned char*>(blob_data), blob_size);
+    }
+#else
+    blob_buffer.clear();
+    blob_buffer.shrink_to_fit();
+#endif
+
+    blob_data = nullptr;
+    blob_size = 0;
+
+}
+
+
+bool weak_rate_blob::find(const std::string& name, table_view_t& view)
+{
+
+    if (blob_data == nullptr) {
+        return false;
+    }
+
+    const unsigned char* dir = blob_data + sizeof(blob_header_t);
+
+    for (std::uint32_t n = 0; n < blob_header.ntables; ++n) {
+
+        const unsigned char* e = dir + n * entry_size();
+
+        const char* entry_name = reinterpret_cast<const char*>(e);
+        if (strnlen(entry_name, blob_header.name_len) != name.size() ||
+            std::memcmp(entry_name, name.data(), name.size()) != 0) {
+            continue;
+        }
+
+        blob_entry_t entry;
+        std::memcpy(&entry, e + blob_header.name_len, sizeof(blob_entry_t));
+
+        const std::size_t ndata = static_cast<std::size_t>(entry.ntemp) * entry.nrhoy * entry.nvars;
+        const std::size_t nbytes = (entry.nrhoy + entry.ntemp + ndata) * sizeof(double);
+
+        if (entry.offset % alignof(double) != 0 || entry.offset + nbytes > blob_size ||
+            table_checksum::crc32(blob_data + entry.offset, nbytes) != entry.checksum) {
+            amrex::Print() << "weak rate blob entry for " << name << " is corrupt, ignoring" << std::endl;
+            return false;
+        }
+
+        const auto* payload = reinterpret_cast<const double*>(blob_data + entry.offset);
+
+        view.ntemp = static_cast<int>(entry.ntemp);
+        view.nrhoy = static_cast<int>(entry.nrhoy);
+        view.nvars = static_cast<int>(entry.nvars);
+        view.log_rhoy = payload;
+        view.log_temp = payload + entry.nrhoy;
+        view.data = payload + entry.nrhoy + entry.ntemp;
+
+        return true;
+    }
+
+    return false;
+
+}
@@ -0,0 +1,9 @@
+#include <nse_guess_data.H>
+
+namespace nse_guess
+{
+    AMREX_GPU_MANAGED bool initialized{false};
+
+    AMREX_GPU_MANAGED amrex::Array3D<amrex::Real, 1, nden, 1, ntemp, 1, nye> mu_p;
+    AMREX_GPU_MANAGED amrex::Array3D<amrex::Real, 1, nden, 1, ntemp, 1, nye> mu_n;
+}
@@ -2,6 +2,8 @@ import numpy as np
 import pynucastro as pyna
 from pynucastro import Nucleus
 
+from make_nse_table_bin import make_table as make_binary_table
+
 
 def get_aprox19_comp(comp):
     aprox19_comp = [Nucleus("he3"), Nucleus("he4"), Nucleus("c12"), Nucleus("n14"),
@@ -149,5 +151,9 @@ def generate_table():
                            comp_reduction_func=get_aprox19_comp,
                            verbose=True)
 
+    # also write the binary version of the table, which is much
+    # faster to read in
+    make_binary_table("nse.tbl", "nse_table_size.H", "nse.bin")
+
 if __name__ == "__main__":
     generate_table()
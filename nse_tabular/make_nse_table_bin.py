@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+
+"""Convert a text NSE table (e.g. nse_aprox19.tbl) into a binary file
+that init_nse can read directly instead of parsing the text.
+
+The grid is taken from the nse_table_size.H header that describes the
+table, and is stored in the binary header so it can be checked against
+the build when the table is read.
+
+The binary table is laid out as (all values little-endian):
+
+  header:
+    char[8]   magic ("MPNSETAB")
+    uint32    byte-order marker (0x01020304)
+    uint32    version
+    uint32    nden (number of density points)
+    uint32    ntemp (number of temperature points)
+    uint32    nye (number of Ye points)
+    uint32    nfields (number of values at each point)
+    float64   logrho_min, logrho_max
+    float64   logT_min, logT_max
+    float64   ye_min, ye_max
+    uint32    CRC-32 of the payload
+    uint32    CRC-32 of the text table it was made from
+
+  payload:
+    float64[nden*ntemp*nye*nfields]
+
+The payload holds the values at each point of the text table (all of
+the columns after log10(rho), log10(T), and Ye) in the same order as
+the text table, with the values at a point varying fastest, then Ye,
+then temperature, then density.  This is the layout of the table in
+memory, so the payload can be read directly into it.
+"""
+
+import argparse
+import re
+import struct
+import sys
+import zlib
+
+import numpy as np
+
+# these need to match table_checksum::nse in util/table_checksum.H
+
+MAGIC = b"MPNSETAB"
+BYTE_ORDER_MARKER = 0x01020304
+VERSION = 2
+
+HEADER_FMT = "<8sIIIIIIddddddII"
+
+# the number of header lines in the text table
+NHEADER = 4
+
+# the number of columns that give the location of the point
+NCOORDS = 3
+
+
+def read_table_size(filename):
+    """get the grid from the constexpr values in nse_table_size.H"""
+
+    size = {}
+    with open(filename) as f:
+        for line in f:
+            m = re.search(r"constexpr\s+(?:int|amrex::Real)\s+(\w+)\s*=\s*([^;]+);", line)
+            if m:
+                size[m.group(1)] = m.group(2).strip()
+
+    keys = ["nden", "ntemp", "nye",
+            "logrho_min", "logrho_max", "logT_min", "logT_max", "ye_min", "ye_max"]
+    missing = [k for k in keys if k not in size]
+    if missing:
+        sys.exit(f"{filename} does not define {', '.join(missing)}")
+
+    for k in ["nden", "ntemp", "nye"]:
+        size[k] = int(size[k])
+    for k in keys[3:]:
+        size[k] = float(re.sub(r"_rt$", "", size[k]))
+
+    return size
+
+
+def make_table(table, table_size, output):
+    """write the binary version of the text table"""
+
+    size = read_table_size(table_size)
+
+    npts = size["nden"] * size["ntemp"] * size["nye"]
+
+    with open(table, "rb") as f:
+        text = f.read()
+
+    lines = text.split(b"\n", NHEADER)
+    if len(lines) <= NHEADER:
+        sys.exit(f"error: {table} has no data")
+
+    # every point has the same number of columns as the first one
+
+    data = lines[NHEADER]
+    ncols = len(data.split(b"\n", 1)[0].split())
+    nfields = ncols - NCOORDS
+
+    values = np.array(data.split(), dtype=np.float64)
+    if values.size != npts * ncols:
+        sys.exit(f"error: {table} has {values.size} values, but {npts} points "
+                 f"with {ncols} columns were expected")
+
+    payload = values.reshape(npts, ncols)[:, NCOORDS:].astype("<f8").tobytes()
+
+    header = struct.pack(HEADER_FMT, MAGIC, BYTE_ORDER_MARKER, VERSION,
+                         size["nden"], size["ntemp"], size["nye"], nfields,
+                         size["logrho_min"], size["logrho_max"],
+                         size["logT_min"], size["logT_max"],
+                         size["ye_min"], size["ye_max"],
+                         zlib.crc32(payload), zlib.crc32(text))
+
+    with open(output, "wb") as f:
+        f.write(header + payload)
+
+
+def main():
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-o", "--output", type=str, default=None,
+                        help="name of the binary table to write (default: the table name with .bin)")
+    parser.add_argument("-s", "--size", type=str, default="nse_table_size.H",
+                        help="the nse_table_size.H describing the table")
+    parser.add_argument("table", type=str,
+                        help="the text table to convert")
+
+    args = parser.parse_args()
+
+    output = args.output
+    if output is None:
+        output = args.table.rsplit(".", 1)[0] + ".bin"
+
+    make_table(args.table, args.size, output)
+
+
+if __name__ == "__main__":
+    main()
@@ -3,13 +3,16 @@
 #ifdef NSE_TABLE
 namespace nse_table
 {
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> abartab;
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> beatab;
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> dyedttab;
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> dabardttab;
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> dbeadttab;
-    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> enutab;
-
-    AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, NumSpec, 1, npts> massfractab;
+#ifdef NODE_SHARED_TABLES
+    amrex::Table2D<amrex::Real> table;
+#ifdef NSE_TABLE_COEFFS
+    amrex::Table2D<amrex::Real> coeffs;
+#endif
+#else
+    AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, nfields, 1, npts> table;
+#ifdef NSE_TABLE_COEFFS
+    AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, ncoeffs, 1, ncells> coeffs;
+#endif
+#endif
 }
 #endif
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+
+"""Compare two sets of EOS benchmark results (the JSON files written
+by the eos_bench unit test) and report the input modes that got
+slower, or took more Newton iterations, than the given tolerance.
+Exits with a nonzero status if there are any regressions, so this can
+be used to catch regressions in CI."""
+
+import argparse
+import json
+import sys
+
+
+def load(filename):
+    """return the EOS name and the results for each supported mode"""
+
+    with open(filename) as f:
+        data = json.load(f)
+
+    return data["eos"], {m["mode"]: m for m in data["modes"] if m["supported"]}
+
+
+def main():
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--tol", type=float, default=0.1,
+                        help="fractional increase that counts as a regression")
+    parser.add_argument("reference", type=str,
+                        help="the JSON file with the reference results")
+    parser.add_argument("new", type=str,
+                        help="the JSON file with the new results")
+
+    args = parser.parse_args()
+
+    ref_eos, ref = load(args.reference)
+    new_eos, new = load(args.new)
+
+    if ref_eos != new_eos:
+        sys.exit(f"the results are for different EOSs: {ref_eos} and {new_eos}")
+
+    regressions = 0
+
+    print(f"{'mode':>6} {'quantity':>22} {'reference':>12} {'new':>12} {'change':>8}")
+
+    for mode, r in ref.items():
+        if mode not in new:
+            print(f"{mode:>6} is no longer supported")
+            regressions += 1
+            continue
+
+        for q in ["warm_ns_per_call", "cold_ns_per_call", "newton_iters_per_call"]:
+            old_val = r[q]
+            new_val = new[mode][q]
+
+            change = (new_val - old_val) / old_val if old_val > 0 else 0.0
+
+            flag = ""
+            if change > args.tol:
+                flag = " <--"
+                regressions += 1
+
+            print(f"{mode:>6} {q:>22} {old_val:12.4g} {new_val:12.4g} {100*change:7.1f}%{flag}")
+
+        if new[mode]["failures"] > r["failures"]:
+            print(f"{mode:>6} failures increased from {r['failures']} to {new[mode]['failures']} <--")
+            regressions += 1
+
+    if regressions > 0:
+        sys.exit(f"{regressions} regressions")
+
+
+if __name__ == "__main__":
+    main()
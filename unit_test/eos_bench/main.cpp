@@ -0,0 +1,25 @@
+#include <iostream>
+
+#include <extern_parameters.H>
+#include <eos.H>
+#include <network.H>
+#include <eos_bench.H>
+#include <unit_test.H>
+
+using namespace unit_test_rp;
+
+int main(int argc, char *argv[]) {
+
+  amrex::Initialize(argc, argv);
+
+  std::cout << "benchmarking the EOS..." << std::endl;
+
+  init_unit_test();
+
+  // C++ EOS initialization (must be done after init_extern_parameters)
+  eos_init(small_temp, small_dens);
+
+  eos_bench();
+
+  amrex::Finalize();
+}
@@ -0,0 +1,40 @@
+#!/bin/bash
+
+# build and run the EOS benchmark for each EOS, writing the results
+# for each to eos_bench_<eos>.json.  Extra arguments are passed to
+# make, e.g., ./run_eos_bench.sh COMP=intel
+
+set -e
+
+# EOS, network (with the network inputs for general_null), and the
+# runtime parameters each needs
+configs=(
+    "helmholtz aprox13"
+    "gamma_law aprox13"
+    "multigamma aprox13 eos.species_a_name=helium-4 eos.species_a_gamma=1.6666 eos.species_b_name=carbon-12 eos.species_b_gamma=1.333333"
+    "polytrope aprox13 eos.polytrope_type=1"
+    "ztwd aprox13"
+    "tillotson aprox13 unit_test.dens_min=1.0 unit_test.dens_max=10.0 unit_test.temp_min=1.e4 unit_test.temp_max=1.e5"
+    "breakout general_null:breakout.net unit_test.uniform_xn=1"
+    "primordial_chem primordial_chem unit_test.uniform_xn=1"
+)
+
+for config in "${configs[@]}"; do
+    read -r eos net params <<< "${config}"
+
+    net_inputs=""
+    if [[ ${net} == *:* ]]; then
+        net_inputs=${net#*:}
+        net=${net%%:*}
+    fi
+
+    echo "benchmarking ${eos} (${net})"
+
+    make realclean > /dev/null
+    make -j 4 EOS_DIR="${eos}" NETWORK_DIR="${net}" NETWORK_INPUTS="${net_inputs}" "$@" > make_${eos}.out 2>&1
+
+    exe=$(ls -t main*.ex | head -1)
+
+    # shellcheck disable=SC2086
+    ./"${exe}" inputs_eos_bench unit_test.json_file="eos_bench_${eos}.json" ${params}
+done
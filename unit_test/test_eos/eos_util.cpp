@@ -12,7 +12,9 @@
 #include <react_util.H>
 #include <extern_parameters.H>
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 using namespace amrex;
 using namespace unit_test_rp;
@@ -95,6 +97,30 @@ void eos_test_C(const Box& bx,
       sp(i, j, k, vars.idpde) = eos_state.dpde;
       sp(i, j, k, vars.idpdre) = eos_state.dpdr_e;
 
+      // the residuals of the thermodynamic consistency (Maxwell)
+      // relations, which measure how consistent the EOS (or its
+      // table) is with a single free energy:
+      //   rho**2 de/drho = p - T dp/dT
+      //   rho**2 ds/drho = -dp/dT
+      //   T ds/dT = de/dT
+
+      sp(i, j, k, vars.ierr_dedr_maxwell) =
+          std::abs(eos_state.rho * eos_state.rho * eos_state.dedr -
+                   (eos_state.p - eos_state.T * eos_state.dpdT)) / eos_state.p;
+
+      sp(i, j, k, vars.ierr_dsdr_maxwell) = 0.0;
+      if (eos_state.dpdT != 0.0) {
+          sp(i, j, k, vars.ierr_dsdr_maxwell) =
+              std::abs(eos_state.rho * eos_state.rho * eos_state.dsdr + eos_state.dpdT) /
+              std::abs(eos_state.dpdT);
+      }
+
+      sp(i, j, k, vars.ierr_dsdT_maxwell) = 0.0;
+      if (eos_state.dedT != 0.0) {
+          sp(i, j, k, vars.ierr_dsdT_maxwell) =
+              std::abs(eos_state.T * eos_state.dsdT - eos_state.dedT) / eos_state.dedT;
+      }
+
 
       // call EOS using rho, h
 
@@ -210,3 +236,174 @@ void eos_test_C(const Box& bx,
 
   });
 }
+
+
+#ifdef HELM_FLOAT_TABLE
+// Compare the helmholtz EOS using the single precision table to the
+// double precision table it was made from.  At the table points, the
+// electron-positron pressure, chemical potential, and number density
+// only depend on the values stored at that point, so we can compute
+// them directly from the double precision table.  Each value at a
+// point is stored to float precision relative to the largest of the
+// (scaled) values there, so we measure the errors relative to that.
+// Returns the largest error.
+
+Real helm_float_table_test() {
+
+    using namespace helmholtz;
+
+    Vector<Real> f_local(static_cast<std::size_t>(9) * imax * jmax);
+    Vector<Real> dpdf_local(static_cast<std::size_t>(4) * imax * jmax);
+    Vector<Real> ef_local(static_cast<std::size_t>(4) * imax * jmax);
+    Vector<Real> xf_local(static_cast<std::size_t>(4) * imax * jmax);
+
+    read_helm_table(f_local, dpdf_local, ef_local, xf_local);
+
+    // the largest of the values at point (j, i), each multiplied by
+    // the density and temperature powers of the derivative it holds
+
+    auto scale = [] (const Real* vals, const int* dpow, const int* tpow, const int n,
+                     const int j, const int i) -> Real
+    {
+        Real vmax = 0.0_rt;
+        for (int m = 0; m < n; ++m) {
+            vmax = std::max(vmax, std::abs(vals[m] * std::pow(d[i], dpow[m]) * std::pow(t[j], tpow[m])));
+        }
+        return std::max(vmax, std::numeric_limits<Real>::min());
+    };
+
+    eos_t state;
+    for (int q = 0; q < NumSpec; ++q) {
+        state.xn[q] = 1.0_rt / NumSpec;
+    }
+
+    // get Ye for this composition, so we can put rho * Ye on the
+    // table points
+
+    state.rho = 1.0_rt;
+    state.T = 1.e6_rt;
+    eos(eos_input_rt, state);
+
+    const Real ye = state.y_e;
+
+    Real err = 0.0_rt;
+
+    for (int j = 0; j < jmax; ++j) {
+        for (int i = 0; i < imax; ++i) {
+            const std::size_t idx = static_cast<std::size_t>(j) * imax + i;
+
+            state.rho = d[i] / ye;
+            state.T = t[j];
+
+            // eos() would move points outside these limits
+            if (state.rho < EOSData::mindens || state.rho > EOSData::maxdens ||
+                state.T < EOSData::mintemp || state.T > EOSData::maxtemp) {
+                continue;
+            }
+
+            eos(eos_input_rt, state);
+
+            const Real din = ye * state.rho;
+
+            // p_ele = din**2 df/dd
+            const Real* fv = &f_local[9 * idx];
+            err = std::max(err, std::abs(state.pele - din * din * fv[3]) /
+                                (din * scale(fv, f_dpow, f_tpow, 9, j, i)));
+
+            const Real* efv = &ef_local[4 * idx];
+            err = std::max(err, std::abs(state.eta - efv[0]) /
+                                scale(efv, cubic_dpow, cubic_tpow, 4, j, i));
+
+            const Real* xfv = &xf_local[4 * idx];
+            err = std::max(err, std::abs(state.xne - xfv[0]) /
+                                scale(xfv, cubic_dpow, cubic_tpow, 4, j, i));
+        }
+    }
+
+    return err;
+}
+#endif
+
+
+#ifdef TEST_EOS_HELMHOLTZ
+// Compare the tabulated Coulomb corrections in the helmholtz EOS
+// (eos.use_eos_coulomb_table) to the analytic fits, first for the fit
+// functions themselves at points between the table nodes, and then
+// for p, e, and s from the EOS for the (rho, T) states stored in the
+// box by eos_test_C().  Returns the largest relative error.
+
+Real coulomb_table_test_C(const Box& bx, const plot_t& vars,
+                          Array4<Real const> const sp) {
+
+    using namespace helmholtz;
+
+    // the table is only filled at initialization if it is used
+
+    const int coulomb_table_save = coulomb_table;
+    if (!coulomb_table) {
+        init_coulomb_table();
+    }
+
+    Real err = 0.0_rt;
+
+    for (int n = 0; n < coul_noct; ++n) {
+        const int e = coul_emin + n;
+        for (int j = 0; j < coul_nper; ++j) {
+            for (int q = 1; q < 4; ++q) {
+                const Real plasg = std::ldexp(1.0_rt + (j + 0.25_rt * q) / coul_nper, e - 1);
+
+                Real exact[6];
+                coulomb_fit(plasg, e >= 1, exact);
+
+                Real fit[4];
+                coulomb_table_eval(plasg, fit);
+
+                // measure the errors relative to the size of each
+                // function on a logarithmic scale in G, since S
+                // passes through zero
+                err = std::max({err,
+                                std::abs(fit[0] - exact[0]) / (std::abs(exact[0]) + std::abs(plasg * exact[1])),
+                                std::abs(fit[1] - exact[1]) / (std::abs(exact[1]) + std::abs(plasg * exact[2])),
+                                std::abs(fit[2] - exact[3]) / (std::abs(exact[3]) + std::abs(plasg * exact[4])),
+                                std::abs(fit[3] - exact[4]) / (std::abs(exact[4]) + std::abs(plasg * exact[5]))});
+            }
+        }
+    }
+
+    auto rel_diff = [] (const Real a, const Real b) -> Real
+    {
+        if (a == b) {
+            return 0.0_rt;
+        }
+        return std::abs(a - b) / std::max(std::abs(b), std::numeric_limits<Real>::min());
+    };
+
+    amrex::LoopOnCpu(bx, [&] (int i, int j, int k)
+    {
+        eos_t analytic;
+
+        analytic.rho = sp(i, j, k, vars.irho);
+        analytic.T = sp(i, j, k, vars.itemp);
+        for (int q = 0; q < NumSpec; ++q) {
+            analytic.xn[q] = sp(i, j, k, vars.ispec+q);
+        }
+
+        eos_t tabulated = analytic;
+
+        coulomb_table = 0;
+        eos(eos_input_rt, analytic);
+
+        coulomb_table = 1;
+        eos(eos_input_rt, tabulated);
+
+        err = std::max({err,
+                        rel_diff(tabulated.p, analytic.p),
+                        rel_diff(tabulated.e, analytic.e),
+                        rel_diff(tabulated.s, analytic.s)});
+    });
+
+    coulomb_table = coulomb_table_save;
+
+    return err;
+}
+#endif
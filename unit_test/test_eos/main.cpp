@@ -142,6 +142,49 @@ void main_main ()
 
     }
 
+    // report the thermodynamic consistency of the EOS
+    amrex::Print() << "max Maxwell relation residuals:" << std::endl;
+    amrex::Print() << "  rho**2 de/drho vs. p - T dp/dT: " << state.max(vars.ierr_dedr_maxwell) << std::endl;
+    amrex::Print() << "  rho**2 ds/drho vs. -dp/dT:      " << state.max(vars.ierr_dsdr_maxwell) << std::endl;
+    amrex::Print() << "  T ds/dT vs. de/dT:              " << state.max(vars.ierr_dsdT_maxwell) << std::endl;
+
+#ifdef HELM_FLOAT_TABLE
+    // check the single precision helmholtz table against the double
+    // precision one.  The Maxwell relations above hold for any table
+    // values, so they cannot measure this.
+    if (ParallelDescriptor::IOProcessor()) {
+        const Real float_err = helm_float_table_test();
+
+        amrex::Print() << "max error of the single precision helmholtz table: " << float_err << std::endl;
+
+        // the values are stored with a relative precision of 2**-24
+        // (~6e-8), so allow for some roundoff in the EOS on top of that
+        if (float_err > 1.e-6_rt) {
+            amrex::Error("the single precision helmholtz table does not agree with the double precision one");
+        }
+    }
+#endif
+
+#ifndef AMREX_USE_GPU
+#ifdef TEST_EOS_HELMHOLTZ
+    // check the tabulated Coulomb corrections against the analytic ones
+    Real coulomb_err = 0.0_rt;
+    for ( MFIter mfi(state); mfi.isValid(); ++mfi )
+    {
+        coulomb_err = std::max(coulomb_err,
+                               coulomb_table_test_C(mfi.validbox(), vars, state.const_array(mfi)));
+    }
+    ParallelDescriptor::ReduceRealMax(coulomb_err);
+
+    amrex::Print() << "max relative error of the tabulated Coulomb corrections: " << coulomb_err << std::endl;
+
+    // the cubic Hermite interpolation is accurate to ~2e-8
+    if (coulomb_err > 1.e-6_rt) {
+        amrex::Error("the tabulated Coulomb corrections do not agree with the analytic ones");
+    }
+#endif
+#endif
+
     // Call the timer again and compute the maximum difference between
     // the start time and stop time over all processors
     Real stop_time = ParallelDescriptor::second() - strt_time;
@@ -55,6 +55,10 @@ plot_t init_variables() {
   p.idpde = p.next_index(1);
   p.idpdre = p.next_index(1);
 
+  p.ierr_dedr_maxwell = p.next_index(1);
+  p.ierr_dsdr_maxwell = p.next_index(1);
+  p.ierr_dsdT_maxwell = p.next_index(1);
+
   return p;
 }
 
@@ -117,6 +121,10 @@ void get_varnames(const plot_t& p, amrex::Vector<std::string>& names) {
   names[p.idpde] = "dp_de_rho";
   names[p.idpdre] = "dp_drho_e";
 
+  names[p.ierr_dedr_maxwell] = "err_dedr_maxwell";
+  names[p.ierr_dsdr_maxwell] = "err_dsdr_maxwell";
+  names[p.ierr_dsdT_maxwell] = "err_dsdT_maxwell";
+
 }
 
 
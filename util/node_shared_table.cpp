@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <climits>
+#include <new>
+#include <string>
+
+#include <AMReX.H>
+#include <AMReX_ParallelDescriptor.H>
+
+#include <node_shared_table.H>
+
+
+void* node_shared_table::allocate(const std::string& name, std::size_t nbytes,
+                                  const std::function<void(void*)>& fill)
+{
+
+#ifdef AMREX_USE_MPI
+
+    MPI_Comm comm = amrex::ParallelDescriptor::Communicator();
+
+    const int rank = amrex::ParallelDescriptor::MyProc();
+    const bool is_io = amrex::ParallelDescriptor::IOProcessor();
+
+    // group the ranks by node, ordering them so the IO processor is
+    // rank 0 on its node
+
+    const int key = is_io ? 0 : rank + 1;
+
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &node_comm);
+
+    int node_rank;
+    MPI_Comm_rank(node_comm, &node_rank);
+
+    // only rank 0 on each node allocates -- the other ranks get a
+    // pointer to its memory.  We check for the allocation failing
+    // ourselves, so we can say which table it was for
+
+    MPI_Comm_set_errhandler(node_comm, MPI_ERRORS_RETURN);
+
+    void* p = nullptr;
+    MPI_Win win;
+    const int ierr = MPI_Win_allocate_shared(node_rank == 0 ? static_cast<MPI_Aint>(nbytes) : 0, 1,
+                                             MPI_INFO_NULL, node_comm, &p, &win);
+
+    if (ierr != MPI_SUCCESS) {
+        amrex::Error("node_shared_table: unable to allocate " + std::to_string(nbytes) +
+                     " bytes of node shared memory for " + name);
+    }
+
+    if (node_rank != 0) {
+        MPI_Aint size;
+        int disp_unit;
+        MPI_Win_shared_query(win, 0, &size, &disp_unit, &p);
+    }
+
+    MPI_Win_fence(0, win);
+
+    if (is_io) {
+        fill(p);
+    }
+
+    // send the table to the other nodes -- the IO processor is rank 0
+    // of the communicator between the node leaders
+
+    MPI_Comm leader_comm;
+    MPI_Comm_split(comm, node_rank == 0 ? 0 : MPI_UNDEFINED, key, &leader_comm);
+
+    if (leader_comm != MPI_COMM_NULL) {
+        auto* bytes = static_cast<char*>(p);
+        for (std::size_t offset = 0; offset < nbytes; offset += INT_MAX) {
+            const int count = static_cast<int>(std::min<std::size_t>(INT_MAX, nbytes - offset));
+            MPI_Bcast(bytes + offset, count, MPI_BYTE, 0, leader_comm);
+        }
+        MPI_Comm_free(&leader_comm);
+    }
+
+    // make the writes visible to all of the ranks on the node
+
+    MPI_Win_fence(0, win);
+
+    MPI_Comm_free(&node_comm);
+
+    amrex::ExecOnFinalize([=] () mutable { MPI_Win_free(&win); });
+
+    return p;
+
+#else
+
+    void* p = ::operator new(nbytes, std::nothrow);
+
+    if (p == nullptr) {
+        amrex::Error("node_shared_table: unable to allocate " + std::to_string(nbytes) +
+                     " bytes for " + name);
+    }
+
+    fill(p);
+
+    amrex::ExecOnFinalize([=] () { ::operator delete(p); });
+
+    return p;
+
+#endif
+
+}